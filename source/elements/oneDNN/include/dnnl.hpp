@@ -81,6 +81,10 @@ struct primitive {
         matmul,
         /// A resampling primitive.
         resampling,
+        /// A reduction primitive.
+        reduction,
+        /// A grouped matmul (matrix multiplication) primitive.
+        grouped_matmul,
     };
 
     /// Default constructor. Constructs an empty object.
@@ -111,6 +115,29 @@ struct primitive {
     void execute(const stream &astream,
             const std::unordered_map<int, memory> &args) const;
 
+    /// Executes computations specified by the primitive in a specified stream
+    /// after the specified dependencies are satisfied.
+    ///
+    /// The function submits the computations and returns without waiting
+    /// for them to finish. The computations start only after all the
+    /// executions represented by @p deps have finished, including the
+    /// executions submitted to other streams. For an in-order stream the
+    /// computations additionally start after all the computations submitted
+    /// earlier to the same stream. For an out-of-order stream the
+    /// computations may start as soon as the dependencies are satisfied,
+    /// possibly concurrently with other computations submitted to the same
+    /// stream.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param args Arguments map.
+    /// @param deps Vector of events that the execution depends on.
+    /// @returns An event object representing the completion of the
+    ///     execution.
+    event execute(const stream &astream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<event> &deps) const;
+
     /// Assignment operator.
     primitive &operator=(const primitive &rhs);
 };
@@ -139,6 +166,29 @@ enum class scratchpad_mode {
     user,
 };
 
+/// Implementation autotuning mode.
+enum class autotune_mode {
+    /// The implementations are ordered by the library heuristics and the
+    /// primitive descriptor uses the first suitable one.
+    heuristic,
+    /// The primitive descriptor creation benchmarks the suitable
+    /// implementations on the actual problem and uses the fastest one. The
+    /// results are cached per problem and per engine.
+    benchmark,
+};
+
+/// Sets the file used to persist the autotuning results between runs of
+/// the application.
+///
+/// The results stored in the file are loaded when this function is called
+/// and the new results are appended to the file when they are obtained.
+/// Results produced by a different version of the library or for a
+/// different CPU instruction set architecture or device are ignored.
+///
+/// @param path Path to the file, or @c nullptr to keep the results in memory
+///     only (default).
+void set_autotune_cache_file(const char *path);
+
 /// Propagation kind.
 enum class prop_kind {
     /// Undefined propagation kind.
@@ -366,6 +416,14 @@ normalization_flags operator|(normalization_flags lhs, normalization_flags rhs);
 enum class rnn_flags : unsigned {
     /// Undefined RNN flags
     undef,
+    /// Persistent execution. The primitive is allowed to keep the
+    /// recurrent weights resident in the caches or registers of the threads
+    /// that execute the recurrent computations across all the time steps,
+    /// and to fuse the gate computations into the matrix multiplications.
+    /// The weights passed to the primitive must not change between
+    /// executions unless the primitive is re-created. This mode targets
+    /// inference with small mini-batch sizes.
+    persistent = 0x1U,
 };
 
 /// Bitwise OR operation for RNN cell flags.
@@ -523,6 +581,19 @@ struct memory {
         s8,
         /// 8-bit unsigned integer.
         u8,
+        /// 4-bit signed integer. Two values are packed into a byte, with the
+        /// value with the lower logical index stored in the lower nibble.
+        s4,
+        /// 4-bit unsigned integer. Two values are packed into a byte, with
+        /// the value with the lower logical index stored in the lower nibble.
+        u4,
+        /// 8-bit floating point with a 5-bit exponent and a 2-bit mantissa
+        /// (E5M2).
+        f8_e5m2,
+        /// 8-bit floating point with a 4-bit exponent and a 3-bit mantissa
+        /// (E4M3). The data type has no infinities, and has a single NaN
+        /// encoding per sign.
+        f8_e4m3,
     };
 
     /// Memory format tag specification.
@@ -739,6 +810,42 @@ struct memory {
         ldgo = abcd,
     };
 
+    /// Sparse encodings.
+    ///
+    /// A memory descriptor with a sparse encoding stores only a subset of
+    /// the tensor elements. The elements that are not stored are zeroes.
+    enum class sparse_encoding {
+        /// Undefined sparse encoding. Used for dense memory descriptors.
+        undef,
+        /// Opaque block-sparse encoding. The tensor is split into
+        /// implementation-defined blocks and only the blocks that contain
+        /// at least one non-zero element are stored, together with the
+        /// metadata describing their positions, in a single buffer. Data in
+        /// this encoding can only be produced by the reorder primitive.
+        packed,
+        /// Opaque N:M structured sparse encoding. Each group of M
+        /// consecutive elements along the reduction dimension of the weights
+        /// (K for MatMul, IC for inner product) contains at most N non-zero
+        /// elements. Only the non-zero values
+        /// and their positions within the groups are stored, in a single
+        /// buffer. Data in this encoding can only be produced by the reorder
+        /// primitive.
+        structured,
+    };
+
+    /// NUMA placement policies for memory buffers allocated by the library
+    /// on the CPU engine.
+    enum class numa_policy {
+        /// The placement is left to the operating system. This is the
+        /// default policy.
+        any,
+        /// The buffer is placed on the specified NUMA node.
+        bind,
+        /// The pages of the buffer are interleaved across all the NUMA
+        /// nodes available to the process.
+        interleave,
+    };
+
     /// A memory descriptor.
     struct desc {
         /// Constructs a zero (empty) memory descriptor. Such a memory
@@ -781,6 +888,56 @@ struct memory {
         desc(const dims &adims, data_type adata_type, const dims &strides,
                 bool allow_empty = false);
 
+        /// Function for creating a memory descriptor for the
+        /// #dnnl::memory::sparse_encoding::packed sparse encoding.
+        ///
+        /// The created memory descriptor cannot be used to create a memory
+        /// object directly from user data. The data must be converted from a
+        /// dense memory format using the reorder primitive.
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type of the non-zero values.
+        /// @param nnz Number of non-zero entries in the tensor. It is used
+        ///     to compute an upper bound of the buffer size.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @returns A memory descriptor for the packed sparse encoding.
+        static desc packed(const dims &adims, data_type adata_type, dim nnz,
+                bool allow_empty = false);
+
+        /// Function for creating a memory descriptor for the
+        /// #dnnl::memory::sparse_encoding::structured sparse encoding.
+        ///
+        /// The created memory descriptor cannot be used to create a memory
+        /// object directly from user data. The data must be converted from a
+        /// dense memory format using the reorder primitive, which fails if
+        /// the source tensor does not satisfy the sparsity pattern.
+        ///
+        /// The groups are formed along the reduction dimension of the
+        /// primitive that consumes the weights, which is specified with
+        /// @p axis: the K dimension (@p adims.size() - 2) for the MatMul
+        /// weights, and the IC dimension (1) for the inner product weights.
+        /// For the inner product weights with spatial dimensions, the groups
+        /// are formed along IC separately for each spatial position.
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type of the non-zero values.
+        /// @param n Maximum number of non-zero elements in a group.
+        /// @param m Number of consecutive elements in a group along the
+        ///     @p axis dimension. Must divide the size of that dimension.
+        /// @param axis Index of the reduction dimension along which the
+        ///     groups are formed.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @returns A memory descriptor for the N:M structured sparse
+        ///     encoding.
+        static desc structured(const dims &adims, data_type adata_type,
+                dim n, dim m, int axis, bool allow_empty = false);
+
         /// Constructs a memory descriptor for a region inside an area
         /// described by this memory descriptor.
         //
@@ -880,6 +1037,20 @@ struct memory {
         ///     for the memory object described by this memory descriptor.
         size_t get_size() const;
 
+        /// Returns the sparse encoding of the memory descriptor.
+        /// @returns The sparse encoding, or
+        ///     #dnnl::memory::sparse_encoding::undef for dense memory
+        ///     descriptors.
+        memory::sparse_encoding get_sparse_encoding() const;
+
+        /// Returns the number of non-zero entries of the memory descriptor.
+        /// @returns The number of non-zero entries for memory descriptors
+        ///     with the #dnnl::memory::sparse_encoding::packed encoding, the
+        ///     maximum number of non-zero entries for memory descriptors
+        ///     with the #dnnl::memory::sparse_encoding::structured encoding,
+        ///     and zero otherwise.
+        dim get_nnz() const;
+
         /// Checks whether the memory descriptor is zero (empty).
         /// @returns @c true if the memory descriptor describes an empty
         ///     memory and @c false otherwise.
@@ -937,6 +1108,20 @@ struct memory {
     /// @param aengine Engine to store the data on.
     memory(const desc &md, const engine &aengine);
 
+    /// Constructs a memory object with the underlying buffer allocated by the
+    /// library according to a NUMA placement policy.
+    ///
+    /// The policy is a hint and is ignored by engines other than the CPU
+    /// engine and on systems without NUMA support.
+    ///
+    /// @param md Memory descriptor.
+    /// @param aengine Engine to store the data on.
+    /// @param policy NUMA placement policy.
+    /// @param numa_node Index of the NUMA node to place the buffer on. Used
+    ///     only with the #dnnl::memory::numa_policy::bind policy.
+    memory(const desc &md, const engine &aengine, numa_policy policy,
+            int numa_node = 0);
+
     /// Returns the associated memory descriptor.
     desc get_desc() const;
 
@@ -1149,13 +1334,34 @@ struct primitive_attr {
     /// @param mode Specified scratchpad mode.
     void set_scratchpad_mode(scratchpad_mode mode);
 
+    /// Returns the autotuning mode.
+    autotune_mode get_autotune_mode() const;
+
+    /// Sets the autotuning mode.
+    ///
+    /// @param mode Specified autotuning mode.
+    void set_autotune_mode(autotune_mode mode);
+
     /// Returns the fpmath mode
     fpmath_mode get_fpmath_mode() const;
 
+    /// Returns the fpmath mode and whether it applies to integral
+    /// primitives.
+    ///
+    /// @param mode Output fpmath mode.
+    /// @param apply_to_int Output flag indicating whether the fpmath mode
+    ///     applies to integral primitives.
+    void get_fpmath_mode(fpmath_mode &mode, bool &apply_to_int) const;
+
     /// Sets fpmath mode.
     ///
     /// @param mode Specified fpmath mode.
-    void set_fpmath_mode(fpmath_mode mode);
+    /// @param apply_to_int A flag indicating whether the fpmath mode also
+    ///     applies to primitives with integral weights. If set, such
+    ///     primitives may convert the weights to a floating-point data type
+    ///     allowed by @p mode and perform the computations in it. This flag
+    ///     is optional and defaults to false.
+    void set_fpmath_mode(fpmath_mode mode, bool apply_to_int = false);
 
     /// Returns scaling factors correspondence mask for a given
     /// memory argument.
@@ -1187,6 +1393,33 @@ struct primitive_attr {
     ///     #DNNL_ARG_ATTR_SCALES.
     void set_scales_mask(int arg, int mask);
 
+    /// Sets grouped scaling factors for a given memory argument.
+    ///
+    /// Compared to #dnnl::primitive_attr::set_scales_mask(), this variant
+    /// allows a dedicated scaling factor for each group of consecutive
+    /// elements along the dimensions selected by @p mask.
+    ///
+    /// @sa dnnl::primitive_attr::set_scales_mask
+    ///
+    /// @param arg Parameter argument index as passed to the
+    ///     primitive::execute() call.
+    /// @param mask Scaling factors correspondence mask that defines the
+    ///     correspondence between the @p arg tensor dimensions and the
+    ///     scales tensor. Setting the i-th bit indicates that a dedicated
+    ///     scaling factor is used for each group of elements along that
+    ///     dimension.
+    /// @param groups Sizes of the groups for the two innermost logical
+    ///     dimensions of the @p arg tensor. Both dimensions must be set in
+    ///     @p mask for a group size bigger than 1, and the group sizes must
+    ///     divide the corresponding dimensions. An empty vector is equivalent
+    ///     to groups of size 1.
+    /// @param data_type Data type of the scaling factors. This parameter is
+    ///     optional and defaults to #dnnl::memory::data_type::f32.
+    ///     The scales must be passed at execution time as an argument with
+    ///     index #DNNL_ARG_ATTR_SCALES.
+    void set_scales(int arg, int mask, const memory::dims &groups,
+            memory::data_type data_type = memory::data_type::f32);
+
     /// Sets zero points for primitive operations for a given memory argument.
     ///
     /// @sa dnnl::primitive_attr::set_output_scales
@@ -1202,6 +1435,28 @@ struct primitive_attr {
     ///     #DNNL_ARG_ATTR_ZERO_POINTS.
     void set_zero_points_mask(int arg, int mask);
 
+    /// Sets grouped zero points for a given memory argument.
+    ///
+    /// @sa dnnl::primitive_attr::set_zero_points_mask
+    /// @sa dnnl::primitive_attr::set_scales
+    ///
+    /// @param arg Parameter argument index as passed to the
+    ///     primitive::execute() call.
+    /// @param mask Zero point correspondence mask that defines the
+    ///     correspondence between the @p arg tensor dimensions and the zero
+    ///     points tensor. Setting the i-th bit indicates that a dedicated
+    ///     zero point is used for each group of elements along that
+    ///     dimension.
+    /// @param groups Sizes of the groups for the two innermost logical
+    ///     dimensions of the @p arg tensor. The same restrictions as for
+    ///     #dnnl::primitive_attr::set_scales() apply.
+    /// @param data_type Data type of the zero points. This parameter is
+    ///     optional and defaults to #dnnl::memory::data_type::s32.
+    ///     The zero points must be passed at execution time as an argument
+    ///     with index #DNNL_ARG_ATTR_ZERO_POINTS.
+    void set_zero_points(int arg, int mask, const memory::dims &groups,
+            memory::data_type data_type = memory::data_type::s32);
+
     /// Returns post-ops previously set via set_post_ops().
     ///
     /// @returns Post-ops.
@@ -1279,6 +1534,15 @@ struct primitive_attr {
     ///     Violations can only be detected when the attributes are used to
     ///     create a primitive descriptor.
     void set_rnn_weights_qparams(int mask, const std::vector<float> &scales);
+
+    /// Returns RNN cell flags previously set via set_rnn_flags().
+    /// @returns RNN cell flags.
+    rnn_flags get_rnn_flags() const;
+
+    /// Sets RNN cell flags. The flags are ignored by non-RNN primitives.
+    ///
+    /// @param flags RNN cell flags. See @ref dnnl::rnn_flags for more info.
+    void set_rnn_flags(rnn_flags flags);
 };
 
 /// @} dnnl_api_attributes
@@ -1291,6 +1555,13 @@ struct primitive_desc_base {
     /// Default constructor. Produces an empty object.
     primitive_desc_base();
 
+    /// Checks whether the primitive descriptor is not empty. A primitive
+    /// descriptor is empty if it was default-constructed or if its
+    /// construction with @c allow_empty set to @c true failed.
+    /// @returns @c true if the primitive descriptor is not empty and
+    ///     @c false otherwise.
+    explicit operator bool() const;
+
     /// Returns the engine of the primitive descriptor.
     /// @returns The engine of the primitive descriptor.
     engine get_engine() const;
@@ -1641,6 +1912,63 @@ struct reorder : public primitive {
     void execute(const stream &astream, memory &src, memory &dst) const;
 };
 
+/// A cache of reordered weights shared across primitives, streams, and
+/// threads.
+///
+/// The cache stores the results of reorders of the user's weights into the
+/// memory formats required by primitives. An entry is keyed by the source
+/// memory buffer, the source memory descriptor, and the destination memory
+/// descriptor, so that all the primitives that require the same weights in
+/// the same memory format share a single reordered copy. The cached memory
+/// objects are immutable: the user must not modify their contents.
+///
+/// All the member functions are thread-safe.
+struct weights_cache {
+    /// Default constructor. Produces an empty object.
+    weights_cache();
+
+    /// Constructs a weights cache for the specified engine.
+    ///
+    /// @param aengine Engine on which the reordered weights are stored.
+    weights_cache(const engine &aengine);
+
+    /// Returns the reordered weights, reordering and caching them if the
+    /// cache does not contain them yet.
+    ///
+    /// If several threads request the same entry concurrently, the reorder
+    /// is executed only once and all the threads receive the same memory
+    /// object.
+    ///
+    /// @param astream Stream to execute the reorder in, if needed. The
+    ///     function waits for the reorder to finish before returning.
+    /// @param src Source memory object with the user's weights. The contents
+    ///     of the source buffer must not change while the entry is cached.
+    /// @param dst_desc Destination memory descriptor, typically queried from
+    ///     a primitive descriptor using #dnnl::primitive_desc_base::weights_desc().
+    /// @param attr Reorder attributes to use (optional). Entries created with
+    ///     different attributes are different.
+    /// @returns A memory object with the reordered weights. The memory object
+    ///     keeps the cached buffer alive even after the entry is removed from
+    ///     the cache.
+    memory get_or_reorder(const stream &astream, const memory &src,
+            const memory::desc &dst_desc,
+            const primitive_attr &attr = primitive_attr());
+
+    /// Removes all the entries with the specified source memory buffer from
+    /// the cache. The buffers of the removed entries are released when the
+    /// last memory object referencing them is destroyed.
+    ///
+    /// @param src Source memory object.
+    void erase(const memory &src);
+
+    /// Removes all the entries from the cache.
+    void clear();
+
+    /// Returns the number of entries in the cache.
+    /// @returns The number of entries.
+    size_t get_size() const;
+};
+
 /// @} dnnl_api_reorder
 
 /// @addtogroup dnnl_api_concat Concat
@@ -3447,6 +3775,10 @@ struct prelu_backward : public primitive {
 /// A primitive to compute reduction operation on data tensor
 /// using min, max, mul, sum, mean and norm_lp operations.
 ///
+/// The primitive supports scales, and eltwise and binary post-ops, which
+/// are applied to the reduced values before they are written to the
+/// destination.
+///
 /// @{
 
 /// Reduction.
@@ -3774,6 +4106,10 @@ struct eltwise_backward : public primitive {
 ///
 /// A primitive to perform softmax.
 ///
+/// The forward propagation primitive supports scales, and eltwise and
+/// binary post-ops, which are applied to the softmax result before it is
+/// written to the destination.
+///
 /// @{
 
 /// Softmax forward propagation primitive.
@@ -4555,6 +4891,12 @@ struct inner_product_backward_weights : public primitive {
 ///
 /// A primitive to compute recurrent neural network layers.
 ///
+/// RNN primitives do not keep any state between executions. For streaming
+/// inference, the recurrent state is carried between executions in the
+/// user's memory objects: the forward propagation primitives support
+/// in-place execution where the destination iteration tensors share the
+/// memory buffers with the corresponding source iteration tensors.
+///
 /// @{
 
 /// Base class for primitive descriptors for RNN primitives.
@@ -6988,6 +7330,109 @@ struct matmul : public primitive {
 
 /// @} dnnl_api_matmul
 
+/// @addtogroup dnnl_api_grouped_matmul Grouped Matrix Multiplication
+///
+/// A primitive to perform multiple independent matrix-matrix multiplications
+/// with possibly different shapes in a single execution.
+///
+/// @{
+
+/// Grouped matrix multiplication (grouped matmul) primitive.
+struct grouped_matmul : public primitive {
+    /// Primitive descriptor for a grouped matmul primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        ///     from lists of problems.
+        ///
+        /// The i-th group computes the product of the 2D source
+        /// @p src_descs[i] and the 2D weights @p weights_descs[i] and writes
+        /// the result to the 2D destination @p dst_descs[i]. All the lists
+        /// must have the same length, which defines the number of groups.
+        /// There is no bias in this mode, and only the common scales and
+        /// zero points (mask 0) are supported.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_descs Memory descriptors for sources (matrices A).
+        /// @param weights_descs Memory descriptors for weights (matrices B).
+        /// @param dst_descs Memory descriptors for destinations (matrices C).
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine,
+                const std::vector<memory::desc> &src_descs,
+                const std::vector<memory::desc> &weights_descs,
+                const std::vector<memory::desc> &dst_descs,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false);
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        ///     with a ragged source and destination.
+        ///
+        /// The rows of the source and destination tensors are split into
+        /// groups by a group offsets tensor passed at execution time. The
+        /// rows in the range [offsets[g], offsets[g + 1]) are multiplied by
+        /// the g-th weights matrix.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Memory descriptor for source of
+        ///     \f$M \times K\f$ shape, where M is the total number of rows
+        ///     in all the groups. M can be #DNNL_RUNTIME_DIM_VAL.
+        /// @param weights_desc Memory descriptor for weights of
+        ///     \f$G \times K \times N\f$ shape, where G is the number of
+        ///     groups.
+        /// @param bias_desc Memory descriptor for bias of \f$G \times N\f$
+        ///     shape. Can be a zero memory descriptor to indicate absence of
+        ///     bias.
+        /// @param dst_desc Memory descriptor for destination of
+        ///     \f$M \times N\f$ shape.
+        /// @param offsets_desc Memory descriptor for the group offsets
+        ///     tensor. Must be a 1D tensor of \f$G + 1\f$ elements of
+        ///     #dnnl::memory::data_type::s32 data type.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc, const memory::desc &bias_desc,
+                const memory::desc &dst_desc, const memory::desc &offsets_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false);
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc(int)const
+        memory::desc src_desc(int idx = 0) const;
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc(int)const
+        memory::desc weights_desc(int idx = 0) const;
+
+        /// @copydoc dnnl::convolution_forward::primitive_desc::bias_desc()const
+        memory::desc bias_desc() const;
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc(int)const
+        memory::desc dst_desc(int idx = 0) const;
+
+        /// Returns the number of groups.
+        /// @returns The number of groups.
+        memory::dim get_group_count() const;
+    };
+
+    /// Default constructor. Produces an empty object.
+    grouped_matmul();
+
+    /// Constructs a grouped matmul primitive.
+    /// @param pd Primitive descriptor for a grouped matmul primitive.
+    grouped_matmul(const primitive_desc &pd);
+};
+
+/// @} dnnl_api_grouped_matmul
+
 /// @addtogroup dnnl_api_resampling Resampling
 ///
 /// A primitive to compute resampling operation on 1D, 2D or 3D data tensor
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <vector>
 
 /// @endcond
 
@@ -120,6 +121,27 @@ struct stream {
 
 };
 
+/// An execution event.
+///
+/// An event is returned by an asynchronous execution of a primitive and
+/// represents the completion of that execution. Events are used to express
+/// dependencies between executions submitted to an out-of-order stream, or
+/// between executions submitted to different streams created for the same
+/// engine.
+struct event {
+    /// Constructs an empty event. An empty event is considered to be
+    /// complete.
+    event();
+
+    /// Waits for the execution represented by the event to finish.
+    void wait() const;
+
+    /// Checks whether the execution represented by the event has finished.
+    /// @returns @c true if the execution has finished and @c false
+    ///     otherwise.
+    bool is_complete() const;
+};
+
 /// @} dnnl_api_stream
 
 /// @addtogroup dnnl_api_fpmath_mode Floating-point Math Mode
@@ -141,6 +163,52 @@ enum class fpmath_mode {
 
 /// @} dnnl_api_fpmath_mode
 
+/// @addtogroup dnnl_api_service Service
+///
+/// A set of functions that aid in oneDNN debugging and profiling.
+///
+/// @{
+
+/// Verbose callback type.
+///
+/// @param record A null-terminated verbose record. The record is valid only
+///     during the callback invocation.
+/// @param user_data The user data pointer passed to
+///     #dnnl::set_verbose_callback().
+using verbose_callback = void (*)(const char *record, void *user_data);
+
+/// Configures verbose output.
+///
+/// The verbose output reports information about the primitives and the
+/// compiled partitions created and executed by the library. The setting
+/// applies to the whole process and can be changed at any time.
+///
+/// @param level Verbosity level:
+///  - 0: no verbose output (default),
+///  - 1: information about the executions of primitives and compiled
+///    partitions,
+///  - 2: level 1 information plus information about the creation of
+///    primitives and the compilation of partitions.
+void set_verbose(int level);
+
+/// Returns the current verbosity level.
+/// @returns The verbosity level set via #dnnl::set_verbose().
+int get_verbose();
+
+/// Sets a callback that receives the verbose records.
+///
+/// By default, the verbose records are printed to the standard output, one
+/// record per line. When a callback is set, the records are passed to the
+/// callback instead. The callback may be invoked concurrently from multiple
+/// threads.
+///
+/// @param callback The callback function, or @c nullptr to restore the
+///     default behavior.
+/// @param user_data A pointer passed to each callback invocation.
+void set_verbose_callback(verbose_callback callback, void *user_data);
+
+/// @} dnnl_api_service
+
 /// @} dnnl_api_common
 
 } // namespace dnnl
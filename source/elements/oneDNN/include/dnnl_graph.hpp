@@ -78,8 +78,51 @@ struct allocator {
   /// @param host_free A pointer to free function for CPU
   allocator(dnnl_graph_host_allocate_f host_malloc,
             dnnl_graph_host_deallocate_f host_free);
+
+  /// Returns the total size of the freed memory blocks kept by a caching
+  /// allocator for reuse.
+  ///
+  /// @returns The size in bytes, or 0 if the allocator is not a caching
+  ///     allocator.
+  size_t get_cached_size() const;
+
+  /// Returns the peak total size of the memory blocks held by a caching
+  /// allocator, including both the blocks in use and the cached ones.
+  ///
+  /// @returns The size in bytes, or 0 if the allocator is not a caching
+  ///     allocator.
+  size_t get_peak_size() const;
+
+  /// Returns the fraction of the allocation requests served by a caching
+  /// allocator from the cached memory blocks.
+  ///
+  /// @returns A value in the range [0, 1], or 0 if the allocator is not a
+  ///     caching allocator or no allocation has been requested yet.
+  float get_hit_rate() const;
+
+  /// Returns all the cached memory blocks of a caching allocator to the
+  /// underlying allocator. The blocks in use are not affected. Does nothing
+  /// if the allocator is not a caching allocator.
+  void release_cached();
 };
 
+/// Creates a caching allocator. A caching allocator keeps the memory blocks
+/// freed by the library in buckets of similar sizes, separately for each
+/// engine and thread, and serves subsequent allocation requests of a matching
+/// size from these buckets instead of calling the underlying allocator. Once
+/// the sizes of the scratchpads and temporary buffers stabilize, for example
+/// in steady-state inference, compiled partitions are executed without any
+/// calls to the underlying allocator.
+///
+/// @param capacity Maximum total size in bytes of the cached memory blocks.
+///     When a freed block does not fit into the capacity, the least recently
+///     used cached blocks are returned to the underlying allocator.
+/// @param upstream The underlying allocator used to allocate and free
+///     memory blocks. The default allocator is used if not specified.
+/// @returns A caching allocator object.
+allocator make_caching_allocator(size_t capacity,
+                                 const allocator &upstream = allocator());
+
 /// @} dnnl_graph_api_allocator
 
 /// @addtogroup dnnl_graph_api_engine Engine
@@ -284,7 +327,8 @@ struct logical_tensor {
 
   /// Returns memory size in bytes required by this logical tensor.
   ///
-  /// @returns The memory size in bytes.
+  /// @returns The memory size in bytes, or 0 if the number of dimensions or
+  ///     any of the dimensions is unknown.
   size_t get_mem_size() const;
 
   /// Compares if two logical tenors are equal. Users can decide accordingly
@@ -366,10 +410,35 @@ struct compiled_partition{
   /// tensor ID doesn't belong to any input or output of the compiled
   /// partition, an exception will be raised by the API.
   ///
+  /// If the partition was compiled with input logical tensors containing
+  /// #DNNL_GRAPH_UNKNOWN_DIM or #DNNL_GRAPH_UNKNOWN_NDIMS, the dimensions of
+  /// the returned logical tensor that depend on them are also
+  /// #DNNL_GRAPH_UNKNOWN_DIM (or the number of dimensions is
+  /// #DNNL_GRAPH_UNKNOWN_NDIMS), and the memory size of the logical tensor is
+  /// 0. The overload that takes concrete input logical tensors must be used
+  /// to get the output shapes and sizes in this case.
+  ///
   /// @param tid The unique id of required tensor.
   /// @returns The logical tensor.
   logical_tensor query_logical_tensor(size_t tid) const;
 
+  /// Queries an output logical tensor of a compiled partition for concrete
+  /// input shapes. This is useful when the partition was compiled with input
+  /// logical tensors containing #DNNL_GRAPH_UNKNOWN_DIM or
+  /// #DNNL_GRAPH_UNKNOWN_NDIMS: the returned logical tensor has the shape,
+  /// the layout, and the memory size of the output tensor that must be
+  /// passed to #execute() together with input tensors of the given shapes.
+  /// If the tensor ID doesn't belong to any output of the compiled partition,
+  /// or if the input shapes are not supported by the compiled partition, an
+  /// exception will be raised by the API.
+  ///
+  /// @param tid The unique id of required output tensor.
+  /// @param inputs A list of input logical tensors with concrete shapes in
+  ///     the same order as passed to the compilation API.
+  /// @returns The logical tensor.
+  logical_tensor query_logical_tensor(
+      size_t tid, const std::vector<logical_tensor> &inputs) const;
+
   /// Returns the hint of in-place pairs from a compiled partition. It
   /// indicates that an input and an output of the partition can share the
   /// same memory buffer for computation. In-place computation helps to reduce
@@ -385,11 +454,37 @@ struct compiled_partition{
 
   /// Execute a compiled partition.
   ///
+  /// If the compiled partition was compiled with unknown dimensions or rank,
+  /// the shapes are taken from the logical tensors of the @p inputs and
+  /// @p outputs tensors, which must be fully specified. The compiled
+  /// partition generates and caches the kernels specialized for each new
+  /// combination of input shapes internally, so the same compiled partition
+  /// can be executed with different shapes without being compiled again.
+  ///
   /// @param astream Stream object to run over.
   /// @param inputs A list of input tensors.
   /// @param outputs A list of output tensors.
   void execute(dnnl::stream &astream, const std::vector<tensor> &inputs,
                const std::vector<tensor> &outputs) const;
+
+  /// Executes a compiled partition asynchronously.
+  ///
+  /// The function submits the computations and returns without waiting for
+  /// them to finish. The computations start after all the executions
+  /// represented by @p deps have finished. The events in @p deps may be
+  /// returned by executions submitted to other streams created for the same
+  /// engine, which allows to execute independent compiled partitions
+  /// concurrently in several streams.
+  ///
+  /// @param astream Stream object to run over.
+  /// @param inputs A list of input tensors.
+  /// @param outputs A list of output tensors.
+  /// @param deps Vector of events that the execution depends on.
+  /// @returns An event object representing the completion of the
+  ///     execution.
+  dnnl::event execute(dnnl::stream &astream, const std::vector<tensor> &inputs,
+                      const std::vector<tensor> &outputs,
+                      const std::vector<dnnl::event> &deps) const;
 };
 
 /// @} dnnl_graph_api_compiled_partition
@@ -457,6 +552,7 @@ struct op {
     Mish ,
     MishBackward ,
     Multiply ,
+    PagedCacheLoad ,
     Pow ,
     PReLU ,
     PReLUBackward ,
@@ -694,6 +790,13 @@ struct partition{
     /// with single operations in each partition. The policy is useful when
     /// users notice any bug or correctness issue in fusion policy.
     debug,
+    /// Max policy returns partitions with the largest fusions supported by
+    /// the library, in addition to the fusions of the fusion policy. For
+    /// example, MatMul + SoftMax + MatMul attention blocks, LayerNorm with
+    /// residual Add chains, or Dequantize + Convolution + Quantize
+    /// patterns. The policy results in fewer partitions and fewer memory
+    /// round trips at the cost of longer partitioning and compilation.
+    max,
   };
 
   partition() = default;
@@ -765,6 +868,32 @@ struct partition{
   engine::kind get_engine_kind() const;
 };
 
+/// Compiles multiple partitions concurrently.
+///
+/// The function is equivalent to calling #dnnl::graph::partition::compile()
+/// for each partition, but the compilations are performed in parallel by up
+/// to @p max_threads threads, and the partitions that are identical are
+/// compiled only once. Two partitions are identical if they contain the same
+/// operations with the same attributes connected in the same way, and if
+/// their input and output logical tensors are the same except for the IDs.
+/// The compiled partitions created for identical partitions share the
+/// generated code. If any of the compilations fails, an exception is raised
+/// after all the other compilations have finished.
+///
+/// @param partitions A list of partitions to compile.
+/// @param inputs A list of input logical tensors for each partition.
+/// @param outputs A list of output logical tensors for each partition.
+/// @param e The engine used to compile the partitions.
+/// @param max_threads Maximum number of threads used for the compilation.
+///     The value 0 means that the number of threads is chosen by the
+///     library.
+/// @returns A list of compiled partitions in the order of @p partitions.
+std::vector<compiled_partition> compile_partitions(
+    const std::vector<partition> &partitions,
+    const std::vector<std::vector<logical_tensor>> &inputs,
+    const std::vector<std::vector<logical_tensor>> &outputs, const engine &e,
+    int max_threads = 0);
+
 /// @} dnnl_graph_api_partition
 
 /// @addtogroup dnnl_graph_api_graph Graph
@@ -825,10 +954,119 @@ struct graph {
   /// @return A vector storing the partitions.
   std::vector<partition>
   get_partitions(partition::policy policy = partition::policy::fusion);
+
+  /// Serializes a graph to a JSON string. The string contains the engine
+  /// kind and the floating-point math mode of the graph, and all the
+  /// operations added to the graph with their attributes and their input and
+  /// output logical tensors. The data of the tensors is not serialized.
+  ///
+  /// @returns A JSON string describing the graph.
+  std::string serialize() const;
+
+  /// Creates a graph from a JSON string produced by #serialize(). The
+  /// operations of the returned graph are added in the order they appear in
+  /// the string, and the graph is not finalized.
+  ///
+  /// @param json A JSON string describing the graph.
+  /// @returns The graph object.
+  static graph deserialize(const std::string &json);
 };
 
 /// @} dnnl_graph_api_graph
 
+/// @addtogroup dnnl_graph_api_memory_plan Memory Plan
+///
+/// A memory plan assigns the tensors passed between compiled partitions to
+/// offsets in a single memory arena, so that the tensors whose lifetimes do
+/// not overlap share the same memory.
+///
+/// @{
+
+/// A memory plan object.
+struct memory_plan {
+  /// Default constructor. Constructs an empty object.
+  memory_plan() = default;
+
+  /// Computes a memory plan for a sequence of compiled partitions.
+  ///
+  /// The compiled partitions are assumed to be executed one after another in
+  /// the given order. The plan is not valid if the partitions are executed
+  /// concurrently, for example in several streams.
+  /// A tensor produced by one compiled partition and consumed by the
+  /// following ones is live from the execution of its producer until the
+  /// execution of its last consumer. The tensors with non-overlapping
+  /// lifetimes are assigned overlapping memory regions of the arena. The
+  /// in-place pairs reported by
+  /// #dnnl::graph::compiled_partition::get_inplace_ports() are assigned the
+  /// same offset when the input is not used after the partition.
+  ///
+  /// The tensors that are not produced by any of the compiled partitions
+  /// (graph inputs), and the tensors listed in @p outputs, are not placed in
+  /// the arena and must be provided by the user.
+  ///
+  /// The sizes of all the tensors placed in the arena must be known at
+  /// compilation time. An exception is raised if any of them has unknown
+  /// dimensions, for example because the partitions were compiled with
+  /// #DNNL_GRAPH_UNKNOWN_DIM in the input shapes.
+  ///
+  /// @param partitions A list of compiled partitions in the execution order.
+  /// @param outputs A list of logical tensors that must stay accessible
+  ///     after the execution of all the partitions (graph outputs).
+  /// @param alignment Alignment of the offsets in bytes.
+  memory_plan(const std::vector<compiled_partition> &partitions,
+              const std::vector<logical_tensor> &outputs,
+              size_t alignment = 64);
+
+  /// Returns the size of the arena required by the plan.
+  ///
+  /// @returns Arena size in bytes.
+  size_t get_arena_size() const;
+
+  /// Checks whether a tensor is placed in the arena.
+  ///
+  /// @param tid The unique id of the tensor.
+  /// @returns @c true if the tensor is placed in the arena and @c false
+  ///     otherwise.
+  bool is_planned(size_t tid) const;
+
+  /// Returns the offset of a tensor in the arena. An exception is raised if
+  /// the tensor is not placed in the arena.
+  ///
+  /// @param tid The unique id of the tensor.
+  /// @returns Offset of the tensor in bytes from the start of the arena.
+  size_t get_offset(size_t tid) const;
+};
+
+/// @} dnnl_graph_api_memory_plan
+
+/// @addtogroup dnnl_graph_api_constant_tensor_cache Constant Tensor Cache
+///
+/// The constant tensor cache keeps the results of the computations that
+/// depend only on constant logical tensors, such as reordered weights, so
+/// that they are computed once and reused across executions of compiled
+/// partitions.
+///
+/// @{
+
+/// Sets the capacity of the constant tensor cache for a specified engine
+/// kind. The cache is shared by all the compiled partitions and threads that
+/// use engines of this kind. If the new capacity is smaller than the size of
+/// the cached tensors, the least recently used tensors are evicted. The
+/// capacity 0 disables the cache and evicts all the cached tensors.
+///
+/// @param kind The engine kind the capacity applies to.
+/// @param size The capacity in megabytes.
+void set_constant_tensor_cache_capacity(engine::kind kind, size_t size);
+
+/// Returns the capacity of the constant tensor cache for a specified engine
+/// kind.
+///
+/// @param kind The engine kind.
+/// @returns The capacity in megabytes.
+size_t get_constant_tensor_cache_capacity(engine::kind kind);
+
+/// @} dnnl_graph_api_constant_tensor_cache
+
 } // namespace graph
 } // namespace dnnl
 
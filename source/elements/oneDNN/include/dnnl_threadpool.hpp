@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2026 UXL Foundation Contributors
+//
+// SPDX-License-Identifier: Apache-2.0
+
+/// @file
+/// oneDNN API with threadpool interoperability
+
+#ifndef DNNL_THREADPOOL_HPP
+#define DNNL_THREADPOOL_HPP
+
+/// @cond DO_NOT_DOCUMENT_THIS
+#include <cstdint>
+#include <functional>
+
+/// @endcond
+
+#include "dnnl.hpp"
+
+/// @addtogroup dnnl_threadpool_interop_api
+///
+/// oneDNN API with threadpool interoperability.
+///
+/// @{
+
+/// oneDNN namespace
+namespace dnnl {
+
+/// Threadpool interoperability namespace
+namespace threadpool_interop {
+
+/// Abstract threadpool interface. The user implements this interface on top
+/// of their threading runtime, such as a oneTBB task arena or a custom
+/// work-stealing pool, and passes it to #dnnl::threadpool_interop::make_stream().
+/// The primitives executed in the stream then submit their parallel work to
+/// the threadpool instead of using the library's own threading.
+struct threadpool_iface {
+    /// Returns the number of worker threads.
+    /// @returns The number of threads that may execute the tasks submitted
+    ///     via #parallel_for() concurrently.
+    virtual int get_num_threads() const = 0;
+
+    /// Returns whether the calling thread is a worker thread of this
+    /// threadpool executing a task.
+    /// @returns @c true if called from within a parallel region of this
+    ///     threadpool and @c false otherwise.
+    virtual bool get_in_parallel() const = 0;
+
+    /// Submits @p n tasks for parallel execution. The tasks are called as
+    /// `fn(i, n)` for each `i` in the range `[0, n)`. Unless the
+    /// #ASYNCHRONOUS flag is set, the function returns after all the tasks
+    /// have finished.
+    ///
+    /// @param n Number of tasks.
+    /// @param fn Task function.
+    virtual void parallel_for(int n, const std::function<void(int, int)> &fn)
+            = 0;
+
+    /// Returns threadpool behavior flags.
+    /// @returns A bit mask of the threadpool flags.
+    virtual uint64_t get_flags() const = 0;
+
+    /// If set, #parallel_for() may return before the tasks have finished.
+    /// In this case the library tracks the completion of the tasks itself,
+    /// and #dnnl::stream::wait() must be called before the results of the
+    /// primitives executed in the stream are accessed.
+    static constexpr uint64_t ASYNCHRONOUS = 1;
+
+    /// Destructor.
+    virtual ~threadpool_iface() {}
+};
+
+/// @addtogroup dnnl_threadpool_interop_api_stream
+///
+/// oneDNN stream API with threadpool interoperability.
+///
+/// @{
+
+/// Creates a stream for a specified CPU engine that executes primitives
+/// using the specified threadpool.
+///
+/// @param aengine CPU engine object to use for the stream.
+/// @param threadpool Pointer to the threadpool to use. The library does not
+///     take the ownership of the threadpool, which must outlive the stream.
+/// @returns Stream object for the @p aengine engine object that uses the
+///     @p threadpool threadpool.
+stream make_stream(const engine &aengine, threadpool_iface *threadpool);
+
+/// Returns the threadpool used by a specified stream object.
+///
+/// @param astream Stream object.
+/// @returns Pointer to the threadpool used by the stream, or @c nullptr if
+///     the stream was not created with
+///     #dnnl::threadpool_interop::make_stream().
+threadpool_iface *get_threadpool(const stream &astream);
+
+/// @} dnnl_threadpool_interop_api_stream
+
+} // namespace threadpool_interop
+} // namespace dnnl
+
+/// @} dnnl_threadpool_interop_api
+
+#endif
@@ -92,6 +92,9 @@
 /// Shift values argument of normalization primitives.
 #define DNNL_ARG_SHIFT 52
 
+/// Group offsets argument of grouped primitives.
+#define DNNL_ARG_GROUP_OFFSETS 53
+
 /// Workspace tensor argument. Workspace is used to pass information
 /// from forward propagation to backward propagation computations.
 #define DNNL_ARG_WORKSPACE 64
@@ -184,6 +187,9 @@
 /// Starting index for destination arguments for primitives that produce a
 /// variable number of destination arguments.
 #define DNNL_ARG_MULTIPLE_DST 2048
+/// Starting index for weights arguments for primitives that take a variable
+/// number of weights arguments.
+#define DNNL_ARG_MULTIPLE_WEIGHTS 3072
 
 /// A wildcard value for dimensions that are unknown at a primitive creation
 /// time.